@@ -0,0 +1,353 @@
+// Checks and times the striping of member summaries (js/striped_bg.js or a
+// replacement) without a browser. The striper runs on a small emulation of
+// the DOM and of the few jQuery functions it uses.
+//
+//   node bench/striped_bg.js [--striper=js/striped_bg.js] [--runs=5]
+//
+// The corpus consists of the tables in bench/fixtures, whose rows carry the
+// expected class in data-stripe, and of generated tables with 10k to 100k
+// rows which are checked against the rules documented in js/striped_bg.js.
+// Exits with status 1 if any row gets a different class.
+var fs = require("fs");
+var path = require("path");
+
+var options = {striper: path.join(__dirname, "..", "js", "striped_bg.js"), runs: 5};
+process.argv.slice(2).forEach(function(arg) {
+    var match = /^--(\w+)=(.*)$/.exec(arg);
+    if (match) {
+        options[match[1]] = match[1] == "runs" ? Number(match[2]) : match[2];
+    }
+});
+
+
+// ---- DOM emulation ----
+
+function Element (tagName, attributes) {
+    var self = this;
+    this.tagName = tagName.toUpperCase();
+    this.attributes = attributes || {};
+    this.children = [];
+    this.parentNode = null;
+    this.classList = {
+        contains: function(name) {
+            return self.className.split(/\s+/).indexOf(name) != -1;
+        },
+        add: function(name) {
+            if (!this.contains(name)) {
+                self.className = self.className ? self.className + " " + name : name;
+            }
+        },
+        remove: function(name) {
+            self.className = self.className.split(/\s+/).filter(function(c) {
+                return c != name;
+            }).join(" ");
+        }
+    };
+}
+
+Object.defineProperty(Element.prototype, "className", {
+    get: function() { return this.attributes["class"] || ""; },
+    set: function(value) { this.attributes["class"] = value; }
+});
+
+Object.defineProperty(Element.prototype, "rows", {
+    get: function() { return this.children; }
+});
+
+Element.prototype.getAttribute = function(name) {
+    return this.attributes.hasOwnProperty(name) ? this.attributes[name] : null;
+};
+
+Element.prototype.appendChild = function(child) {
+    child.parentNode = this;
+    this.children.push(child);
+    return child;
+};
+
+// simple selectors: ".name", "tag", '[attr^="value"]', and "A B" for descendants
+function matches(element, selector) {
+    var match;
+    if ((match = /^\.([\w-]+)$/.exec(selector))) {
+        return element.classList.contains(match[1]);
+    }
+    if ((match = /^\[([\w-]+)\^="([^"]*)"\]$/.exec(selector))) {
+        var value = element.getAttribute(match[1]);
+        return value !== null && value.indexOf(match[2]) == 0;
+    }
+    if (/^[\w]+$/.test(selector)) {
+        return element.tagName == selector.toUpperCase();
+    }
+    throw new Error("selector not supported: " + selector);
+}
+
+function querySelectorAll(root, selector) {
+    var parts = selector.trim().split(/\s+/);
+    var found = [root];
+    parts.forEach(function(part) {
+        var next = [];
+        found.forEach(function(element) {
+            (function visit(node) {
+                node.children.forEach(function(child) {
+                    if (matches(child, part) && next.indexOf(child) == -1) {
+                        next.push(child);
+                    }
+                    visit(child);
+                });
+            })(element);
+        });
+        found = next;
+    });
+    return found;
+}
+
+function Document () {
+    this.documentElement = new Element("html");
+    this.body = this.documentElement.appendChild(new Element("body"));
+}
+
+Document.prototype.querySelectorAll = function(selector) {
+    return querySelectorAll(this.documentElement, selector);
+};
+
+Document.prototype.getElementsByClassName = function(name) {
+    return this.querySelectorAll("." + name);
+};
+
+// the part of jQuery used by the striper
+function createJQuery(document, readyHandlers) {
+    function Wrapped(elements) {
+        this.elements = elements;
+        this.length = elements.length;
+    }
+    Wrapped.prototype.ready = function(func) {
+        readyHandlers.push(func);
+        return this;
+    };
+    Wrapped.prototype.children = function() {
+        var children = [];
+        this.elements.forEach(function(element) {
+            children.push.apply(children, element.children);
+        });
+        return new Wrapped(children);
+    };
+    Wrapped.prototype.each = function(func) {
+        this.elements.forEach(function(element, i) {
+            func.call(element, i, element);
+        });
+        return this;
+    };
+    Wrapped.prototype.is = function(selector) {
+        return this.elements.some(function(element) {
+            return selector.split(",").some(function(part) {
+                return matches(element, part.trim());
+            });
+        });
+    };
+    Wrapped.prototype.addClass = function(name) {
+        this.elements.forEach(function(element) {
+            element.classList.add(name);
+        });
+        return this;
+    };
+
+    return function(arg) {
+        if (typeof arg == "function") {
+            readyHandlers.push(arg);
+            return new Wrapped([]);
+        }
+        if (typeof arg == "string") {
+            return new Wrapped(document.querySelectorAll(arg));
+        }
+        return new Wrapped(arg === document ? [] : [arg]);
+    };
+}
+
+
+// ---- corpus ----
+
+// the rows of all member tables in an html file, doxygen omits the tbody
+function parseFixture(html) {
+    var tables = [];
+    var tableRe = /<table class="memberdecls">([\s\S]*?)<\/table>/g;
+    var table;
+    while ((table = tableRe.exec(html))) {
+        var rows = [];
+        var rowRe = /<tr((?:\s+[\w-]+="[^"]*")*)\s*>/g;
+        var row;
+        while ((row = rowRe.exec(table[1]))) {
+            var attributes = {};
+            row[1].replace(/([\w-]+)="([^"]*)"/g, function(all, name, value) {
+                attributes[name] = value;
+            });
+            rows.push(attributes);
+        }
+        tables.push(rows);
+    }
+    return tables;
+}
+
+// deterministic pseudo random numbers so every run uses the same tables
+function random(seed) {
+    return function() {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        return seed / 2147483648;
+    };
+}
+
+// member summaries with the row patterns doxygen writes: plain members,
+// members with description, templates (an extra memitem row for the
+// template parameters), member groups and collapsed inherited groups
+function generateTables(totalRows, seed) {
+    var next = random(seed);
+    var tables = [];
+    var count = 0;
+    var member = 0;
+    while (count < totalRows) {
+        var rows = [{"class": "heading"}];
+        var sectionSize = 20 + Math.floor(next() * 2000);
+        var inheritId = null;
+        for (var i = 0; i < sectionSize && count + rows.length < totalRows; ++i) {
+            var id = "a" + (member++).toString(16);
+            var inherit = "";
+            var kind = next();
+            if (kind < 0.02) {
+                inheritId = "pub_methods_classBase" + member;
+                rows.push({"class": "inherit_header " + inheritId});
+            }
+            else if (kind < 0.03) {
+                rows.push({});  // header of a member group
+            }
+            if (inheritId !== null) {
+                inherit = " inherit " + inheritId;
+            }
+            if (next() < 0.15) {
+                rows.push({"class": "memitem:" + id + inherit});
+            }
+            rows.push({"class": "memitem:" + id + inherit});
+            if (next() < 0.6) {
+                rows.push({"class": "memdesc:" + id + inherit});
+            }
+            rows.push({"class": "separator:" + id + inherit});
+        }
+        count += rows.length;
+        tables.push(rows);
+    }
+    // doxygen starts every table with a heading, the counter is still
+    // carried over between tables, so check that too with a table that
+    // has to start with "odd"
+    if (tables.length > 1) {
+        var previous = tables[tables.length-2];
+        var separators = previous.filter(function(row) {
+            return /^separator/.test(row["class"]);
+        }).length;
+        if (separators % 2 == 0) {
+            previous.push({"class": "memitem:a" + member.toString(16)},
+                          {"class": "separator:a" + member.toString(16)});
+        }
+        tables[tables.length-1].shift();
+    }
+    return tables;
+}
+
+// the rules from js/striped_bg.js
+function expectedStripes(tables) {
+    var counter = 0;
+    tables.forEach(function(rows) {
+        rows.forEach(function(row) {
+            var className = row["class"] || "";
+            if (className.split(/\s+/).indexOf("heading") != -1) {
+                counter = 0;
+            }
+            row.expected = counter % 2 == 1 ? "odd" : "even";
+            if (className.indexOf("separator") == 0) {
+                counter++;
+            }
+        });
+    });
+}
+
+function buildDocument(tables) {
+    var document = new Document();
+    tables.forEach(function(rows) {
+        var table = document.body.appendChild(new Element("table", {"class": "memberdecls"}));
+        var tbody = table.appendChild(new Element("tbody"));
+        rows.forEach(function(row) {
+            var attributes = {};
+            for (var name in row) {
+                if (name != "expected" && name != "data-stripe") {
+                    attributes[name] = row[name];
+                }
+            }
+            tbody.appendChild(new Element("tr", attributes));
+        });
+    });
+    return document;
+}
+
+
+// ---- run ----
+
+var striperSource = fs.readFileSync(options.striper, "utf8");
+
+// runs the striper on a fresh document, returns the time and the rows
+function stripe(tables) {
+    var document = buildDocument(tables);
+    var readyHandlers = [];
+    var $ = createJQuery(document, readyHandlers);
+    var window = {document: document, jQuery: $, $: $};
+    new Function("$", "jQuery", "document", "window", striperSource)($, $, document, window);
+
+    var start = process.hrtime.bigint();
+    readyHandlers.forEach(function(handler) { handler.call(document, $); });
+    var time = Number(process.hrtime.bigint() - start) / 1e9;
+
+    var rows = [];
+    document.querySelectorAll("tbody").forEach(function(tbody) {
+        rows.push.apply(rows, tbody.children);
+    });
+    return {time: time, rows: rows};
+}
+
+function check(name, tables) {
+    var expected = [];
+    tables.forEach(function(rows) { expected.push.apply(expected, rows); });
+
+    var best = Infinity;
+    var failures = 0;
+    for (var run = 0; run < options.runs; ++run) {
+        var result = stripe(tables);
+        best = Math.min(best, result.time);
+        if (run > 0) {
+            continue;
+        }
+        result.rows.forEach(function(row, i) {
+            var stripes = ["odd", "even"].filter(function(c) { return row.classList.contains(c); });
+            if (stripes.length != 1 || stripes[0] != expected[i].expected) {
+                if (failures++ < 5) {
+                    console.log("  row " + i + " (" + (expected[i]["class"] || "no class") + "): expected "
+                                + expected[i].expected + ", got " + (stripes.join(" ") || "nothing"));
+                }
+            }
+        });
+    }
+    console.log((failures == 0 ? "ok    " : "FAIL  ") + name + ": " + expected.length + " rows, "
+                + Math.round(expected.length / best).toLocaleString("en") + " rows/s"
+                + (failures > 0 ? ", " + failures + " wrong rows" : ""));
+    return failures == 0;
+}
+
+var ok = true;
+var fixtures = path.join(__dirname, "fixtures");
+fs.readdirSync(fixtures).filter(function(file) { return /\.html$/.test(file); }).sort().forEach(function(file) {
+    var tables = parseFixture(fs.readFileSync(path.join(fixtures, file), "utf8"));
+    tables.forEach(function(rows) {
+        rows.forEach(function(row) { row.expected = row["data-stripe"]; });
+    });
+    ok = check(file, tables) && ok;
+});
+[10000, 30000, 100000].forEach(function(size, i) {
+    var tables = generateTables(size, i + 1);
+    expectedStripes(tables);
+    ok = check("generated " + size, tables) && ok;
+});
+process.exit(ok ? 0 : 1);
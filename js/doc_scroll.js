@@ -0,0 +1,51 @@
+// Switches pages with the tree view to a layout in which the whole document
+// scrolls and CSS (see _doc_scroll.scss) sizes the side nav and the content.
+// Has to be loaded after doxygen's resize.js and navtree.js, i.e. after
+// $treeview.
+function DocumentScroller () {
+    // navtree.js animates the scroll position of #doc-content to reach an
+    // anchor, which does not scroll anymore
+    function gotoAnchor(anchor, aname, updateLocation) {
+        var parent = anchor.parent();
+        var target = parent.is("td.memItemLeft, td.fieldname, td.fieldtype, :header") ? parent : anchor;
+        if (target.length == 0) {
+            return;
+        }
+        target[0].scrollIntoView();
+        if (updateLocation) {
+            window.location.href = aname;
+        }
+        if (typeof glowEffect == "function") {
+            glowEffect(anchor.next(), 1000);
+        }
+    }
+
+    this.install = function() {
+        // no tree view -> nothing to do
+        if (typeof initResizable != "function") {
+            return;
+        }
+
+        // set the class right away to avoid a relayout after the first paint
+        document.documentElement.className += " doc-scroll";
+
+        if (typeof window.gotoAnchor == "function") {
+            window.gotoAnchor = gotoAnchor;
+        }
+
+        // initResizable binds a handler to the resize event of the window
+        // which sets pixel heights on the side nav and #doc-content, CSS
+        // takes care of that now. It runs as a ready handler of the page,
+        // wait until all of those are done before removing it. The heights
+        // set once on load are overridden by the stylesheet. The splitbar
+        // and the collapsing of the tree keep working.
+        $(document).ready(function() {
+            setTimeout(function() {
+                $(window).off("resize");
+            }, 0);
+        });
+    }
+}
+
+// execute the function
+new DocumentScroller().install();
@@ -0,0 +1,240 @@
+// Opens the graphs generated by dot in a full screen viewer which can be
+// panned by dragging and zoomed with the mouse wheel. The graph is moved as
+// a whole by a CSS transform instead of being laid out and painted again.
+// Links of the nodes are found through a grid of the node boxes which is
+// built from the image map (png) or the links in the file (svg).
+function GraphViewer (cellSize) {
+    var viewer = null;
+    var layer = null;
+    var image = null;
+    var nodes = null;       // grid cell -> list of {left, top, right, bottom, href}
+    var base = "";          // URL the links of the graph are relative to
+    var x = 0, y = 0, scale = 1;
+    var frameRequested = false;
+    var settleTimer = null;
+    var drag = null;
+    var opener = null;      // button that opened the viewer, focused again on close
+
+    function addNode(node) {
+        for (var cx = Math.floor(node.left / cellSize); cx <= Math.floor(node.right / cellSize); ++cx) {
+            for (var cy = Math.floor(node.top / cellSize); cy <= Math.floor(node.bottom / cellSize); ++cy) {
+                var key = cx + "," + cy;
+                (nodes[key] = nodes[key] || []).push(node);
+            }
+        }
+    }
+
+    function nodeAt(px, py) {
+        var cell = nodes[Math.floor(px / cellSize) + "," + Math.floor(py / cellSize)] || [];
+        for (var i = 0; i < cell.length; ++i) {
+            if (px >= cell[i].left && px <= cell[i].right && py >= cell[i].top && py <= cell[i].bottom) {
+                return cell[i];
+            }
+        }
+        return null;
+    }
+
+    // bounding box of an area of an image map
+    function areaBox(area) {
+        var c = area.getAttribute("coords").split(",").map(Number);
+        var shape = (area.getAttribute("shape") || "rect").toLowerCase();
+        if (shape == "circle") {
+            return {left: c[0] - c[2], top: c[1] - c[2], right: c[0] + c[2], bottom: c[1] + c[2]};
+        }
+        if (shape == "poly") {
+            var box = {left: Infinity, top: Infinity, right: -Infinity, bottom: -Infinity};
+            for (var i = 0; i + 1 < c.length; i += 2) {
+                box.left = Math.min(box.left, c[i]);
+                box.right = Math.max(box.right, c[i]);
+                box.top = Math.min(box.top, c[i+1]);
+                box.bottom = Math.max(box.bottom, c[i+1]);
+            }
+            return box;
+        }
+        return {left: c[0], top: c[1], right: c[2], bottom: c[3]};
+    }
+
+    // areas of the image map that belongs to a png
+    function indexMap(img) {
+        var map = document.getElementsByName(img.getAttribute("usemap").substr(1))[0];
+        if (!map) {
+            return;
+        }
+        $(map).find("area[href]").each(function() {
+            var node = areaBox(this);
+            node.href = this.getAttribute("href");
+            addNode(node);
+        });
+    }
+
+    // linked polygons in a svg written by dot, translated by the graph's
+    // transform and scaled from the viewBox to the size of the image
+    function indexSvg(text, width, height) {
+        var svg = new DOMParser().parseFromString(text, "image/svg+xml").documentElement;
+        var viewBox = (svg.getAttribute("viewBox") || "0 0 " + width + " " + height).split(/[ ,]+/).map(Number);
+        var sx = width / viewBox[2], sy = height / viewBox[3];
+        var graph = svg.querySelector("g.graph");
+        var translate = /translate\(([-\d.]+)[ ,]+([-\d.]+)\)/.exec(graph ? graph.getAttribute("transform") : "")
+            || [0, 0, 0];
+
+        var links = svg.getElementsByTagName("a");
+        for (var i = 0; i < links.length; ++i) {
+            var href = links[i].getAttribute("xlink:href") || links[i].getAttribute("href");
+            var polygon = links[i].getElementsByTagName("polygon")[0];
+            if (!href || !polygon) {
+                continue;
+            }
+            var points = polygon.getAttribute("points").trim().split(/[ ,]+/).map(Number);
+            var node = {left: Infinity, top: Infinity, right: -Infinity, bottom: -Infinity, href: href};
+            for (var j = 0; j + 1 < points.length; j += 2) {
+                var px = (points[j] + Number(translate[1]) - viewBox[0]) * sx;
+                var py = (points[j+1] + Number(translate[2]) - viewBox[1]) * sy;
+                node.left = Math.min(node.left, px);
+                node.right = Math.max(node.right, px);
+                node.top = Math.min(node.top, py);
+                node.bottom = Math.max(node.bottom, py);
+            }
+            addNode(node);
+        }
+    }
+
+    function update() {
+        frameRequested = false;
+        layer.style.transform = "translate(" + x + "px, " + y + "px) scale(" + scale + ")";
+    }
+
+    function requestUpdate() {
+        // keep the layer composited while moving, let the browser draw it
+        // sharply again at the new scale once it has come to rest
+        viewer.classList.add("moving");
+        clearTimeout(settleTimer);
+        settleTimer = setTimeout(function() { viewer.classList.remove("moving"); }, 200);
+        if (!frameRequested) {
+            frameRequested = true;
+            window.requestAnimationFrame(update);
+        }
+    }
+
+    function create() {
+        viewer = document.createElement("div");
+        viewer.id = "graph-viewer";
+        viewer.innerHTML = '<div class="layer"><img alt=""/></div>'
+            + '<a class="close" href="#" role="button" title="Close">&#x2715;</a>';
+        document.body.appendChild(viewer);
+        layer = viewer.firstChild;
+        image = layer.firstChild;
+
+        viewer.addEventListener("wheel", function(e) {
+            e.preventDefault();
+            var factor = Math.pow(1.0015, -e.deltaY);
+            var newScale = Math.min(8, Math.max(0.05, scale * factor));
+            // zoom around the mouse pointer
+            x = e.clientX - (e.clientX - x) * newScale / scale;
+            y = e.clientY - (e.clientY - y) * newScale / scale;
+            scale = newScale;
+            requestUpdate();
+        }, {passive: false});
+
+        viewer.lastChild.addEventListener("click", function(e) {
+            e.preventDefault();
+            close();
+        });
+        viewer.addEventListener("pointerdown", function(e) {
+            if (e.target === viewer.lastChild) {
+                return;
+            }
+            drag = {x: e.clientX, y: e.clientY, startX: x, startY: y, moved: false};
+            viewer.setPointerCapture(e.pointerId);
+        });
+        viewer.addEventListener("pointermove", function(e) {
+            if (drag === null) {
+                return;
+            }
+            if (Math.abs(e.clientX - drag.x) + Math.abs(e.clientY - drag.y) > 4) {
+                drag.moved = true;
+            }
+            x = drag.startX + e.clientX - drag.x;
+            y = drag.startY + e.clientY - drag.y;
+            requestUpdate();
+        });
+        viewer.addEventListener("pointerup", function(e) {
+            var click = drag !== null && !drag.moved;
+            drag = null;
+            if (!click) {
+                return;
+            }
+            var node = nodeAt((e.clientX - x) / scale, (e.clientY - y) / scale);
+            if (node !== null) {
+                location.href = new URL(node.href, base).href;
+            }
+        });
+
+        $(document).on("keydown", function(e) {
+            if (e.key == "Escape" && viewer.style.display == "block") {
+                close();
+            }
+        });
+    }
+
+    function close() {
+        viewer.style.display = "none";
+        image.removeAttribute("src");
+        if (opener !== null) {
+            opener.focus();
+        }
+    }
+
+    function open(container) {
+        var graph = $(container).find('img[usemap], img[src$=".svg"], iframe[src$=".svg"], object[data$=".svg"]')[0];
+        if (!graph) {
+            return;
+        }
+        if (viewer === null) {
+            create();
+        }
+
+        var src = graph.getAttribute("src") || graph.getAttribute("data");
+        base = new URL(src, document.baseURI).href;
+        nodes = {};
+        image.onload = function() {
+            var width = image.naturalWidth, height = image.naturalHeight;
+            // fit into the window
+            scale = Math.min(1, viewer.clientWidth / width, viewer.clientHeight / height);
+            x = (viewer.clientWidth - width * scale) / 2;
+            y = (viewer.clientHeight - height * scale) / 2;
+            requestUpdate();
+
+            if (/\.svg$/.test(src)) {
+                fetch(base).then(function(response) { return response.text(); })
+                    .then(function(text) { indexSvg(text, width, height); })
+                    .catch(function() {});  // the graph can still be viewed
+            }
+            else {
+                indexMap(graph);
+            }
+        };
+        image.src = src;
+        viewer.style.display = "block";
+        viewer.lastChild.focus();
+    }
+
+    this.install = function() {
+        $(document).ready(function() {
+            $("div.dotgraph, div.dyncontent div.center").each(function() {
+                if ($(this).find('img[usemap], img[src$=".svg"], iframe[src$=".svg"], object[data$=".svg"]').length > 0) {
+                    $(this).addClass("graph-viewer-container")
+                        .prepend('<a class="graph-viewer-open" href="#" role="button"'
+                                 + ' title="Open in viewer">&#x2922;</a>');
+                }
+            });
+            $(document).on("click", "a.graph-viewer-open", function(e) {
+                e.preventDefault();
+                opener = this;
+                open(this.parentNode);
+            });
+        });
+    }
+}
+
+// execute the function
+new GraphViewer(64).install();
@@ -0,0 +1,39 @@
+// Takes the hidden rows of inherited members out of the document after they
+// have been striped and puts them back when their group is expanded for the
+// first time. Keeps the DOM of classes with deep hierarchies small, the
+// rows are still downloaded and parsed with the page.
+// Has to be loaded after striped_bg.js.
+function InheritedMembers () {
+    var detached = {};  // rows of collapsed groups by group id
+
+    this.install = function() {
+        $(document).ready(function() {
+            if (typeof toggleInherit != "function") {
+                return;
+            }
+
+            $("tr.inherit_header").each(function() {
+                var id = $.grep(this.className.split(" "), function(name) {
+                    return name != "" && name != "inherit_header";
+                })[0];
+                var rows = $("tr.inherit." + id);
+                if (id && rows.length > 0) {
+                    detached[id] = rows.detach();
+                }
+            });
+
+            // replaces toggleInherit from doxygen's dynsections.js
+            var doxygenToggleInherit = toggleInherit;
+            toggleInherit = function(id) {
+                if (detached[id]) {
+                    $("tr.inherit_header." + id).after(detached[id]);
+                    delete detached[id];
+                }
+                doxygenToggleInherit(id);
+            };
+        });
+    }
+}
+
+// execute the function
+new InheritedMembers().install();
@@ -0,0 +1,75 @@
+// Defers building the big submenus of the main menu (e.g. the alphabetical
+// lists under "Class Members") until they are opened for the first time.
+// At most maxEntries items are shown, followed by a "more…" link to the index.
+function LazyMenu (maxEntries) {
+    // submenus that have not been built yet, indexed by the placeholder link
+    var pending = [];
+
+    function isLeaf(node) {
+        return !node.children || node.children.length == 0;
+    }
+
+    // moves the entries of the submenus below the second level that only
+    // hold links (the alphabetical lists) into pending and leaves a single
+    // placeholder so the menu still shows an arrow, the submenus leading
+    // to them are small and built by doxygen as usual
+    function prune(node, depth) {
+        if (isLeaf(node)) {
+            return;
+        }
+        if (depth >= 2 && node.children.every(isLeaf)) {
+            pending.push({url: node.url, children: node.children});
+            node.children = [{text: "…",
+                              url: node.url + "#lazy-menu-" + (pending.length-1)}];
+            return;
+        }
+        for (var i = 0; i < node.children.length; ++i) {
+            prune(node.children[i], depth+1);
+        }
+    }
+
+    // replaces the placeholder in ul by the actual entries
+    function build(ul, relPath) {
+        var placeholder = $(ul).children("li").children('a[href*="#lazy-menu-"]');
+        if (placeholder.length == 0) {
+            return;
+        }
+        var href = placeholder.attr("href");
+        var menu = pending[parseInt(href.substr(href.lastIndexOf("-")+1))];
+
+        var html = "";
+        for (var i = 0; i < menu.children.length && i < maxEntries; ++i) {
+            html += '<li><a href="' + relPath + menu.children[i].url + '">'
+                + menu.children[i].text + '</a></li>';
+        }
+        if (menu.children.length > maxEntries) {
+            html += '<li><a class="lazy-menu-more" href="' + relPath + menu.url
+                + '">more…</a></li>';
+        }
+        $(ul).html(html);
+    }
+
+    // wraps doxygen's initMenu (from menu.js) which is called after this
+    // script has been loaded but before the menu is built
+    this.install = function() {
+        if (typeof initMenu != "function" || typeof menudata != "object") {
+            return;
+        }
+
+        var doxygenInitMenu = initMenu;
+        initMenu = function(relPath) {
+            prune(menudata, 0);
+            doxygenInitMenu.apply(this, arguments);
+
+            $("#main-menu").on("mouseenter focusin", "li", function() {
+                var ul = $(this).children("ul");
+                if (ul.length > 0) {
+                    build(ul[0], relPath);
+                }
+            });
+        };
+    };
+}
+
+// install before doxygen's own ready handler calls initMenu
+$(document).ready(new LazyMenu(50).install);
@@ -0,0 +1,177 @@
+// Keeps only the rows of large member summaries in the document that are
+// near the visible part of the page. The other rows are cut into chunks
+// which are replaced by a single empty row of the same height until they
+// are scrolled into view. Headings always stay in place so the links of
+// the summary at the top of the page keep working, links to rows of
+// detached chunks put them back first.
+// The rows are taken out when the page is ready without measuring them,
+// only the first screen of each table stays. Until a chunk has been shown
+// its placeholder gets a height estimated from the number of rows.
+// Has to be loaded after striped_bg.js and inherited_members.js.
+function MemberTables (chunkSize, minRows, margin, rowHeight) {
+    var chunks = [];        // {rows, start, placeholder, attached, height}
+    var scroller = window;
+    var frameRequested = false;
+
+    function isBoundary(row) {
+        return /(^| )(heading|inherit_header|inherit)( |$)/.test(row.className);
+    }
+
+    // runs of rows between headings, split before a member once they are long enough
+    function split(tbody) {
+        var rows = tbody.rows;
+        if (rows.length < minRows) {
+            return;
+        }
+        var chunk = [];
+        var start = 0;
+        function flush() {
+            if (chunk.length > 0) {
+                chunks.push({rows: chunk, start: start, placeholder: null, attached: true,
+                             height: estimate(chunk)});
+                chunk = [];
+            }
+        }
+        for (var i = 0; i < rows.length; ++i) {
+            if (isBoundary(rows[i])) {
+                flush();
+                continue;
+            }
+            if (chunk.length >= chunkSize && /^memitem/.test(rows[i].className)) {
+                flush();
+            }
+            if (chunk.length == 0) {
+                start = i;
+            }
+            chunk.push(rows[i]);
+        }
+        flush();
+    }
+
+    // separators are a single line of pixels, all other rows one line of text
+    function estimate(rows) {
+        var height = 0;
+        for (var i = 0; i < rows.length; ++i) {
+            height += /^separator/.test(rows[i].className) ? 1 : rowHeight;
+        }
+        return height;
+    }
+
+    function attach(chunk) {
+        var fragment = document.createDocumentFragment();
+        for (var i = 0; i < chunk.rows.length; ++i) {
+            fragment.appendChild(chunk.rows[i]);
+        }
+        chunk.placeholder.parentNode.replaceChild(fragment, chunk.placeholder);
+        chunk.attached = true;
+    }
+
+    function detach(chunk) {
+        if (chunk.placeholder === null) {
+            chunk.placeholder = document.createElement("tr");
+            chunk.placeholder.className = "memberdecls-placeholder";
+            chunk.placeholder.innerHTML = '<td colspan="2"></td>';
+        }
+        chunk.placeholder.firstChild.style.height = chunk.height + "px";
+        chunk.rows[0].parentNode.insertBefore(chunk.placeholder, chunk.rows[0]);
+        for (var i = 0; i < chunk.rows.length; ++i) {
+            chunk.rows[i].parentNode.removeChild(chunk.rows[i]);
+        }
+        chunk.attached = false;
+    }
+
+    function update() {
+        frameRequested = false;
+        var view = scroller === window ? {top: 0, bottom: window.innerHeight}
+                                       : scroller.getBoundingClientRect();
+
+        // measure everything first, then change the document
+        var changes = [];
+        for (var i = 0; i < chunks.length; ++i) {
+            var chunk = chunks[i];
+            var top, bottom;
+            if (chunk.attached) {
+                top = chunk.rows[0].getBoundingClientRect().top;
+                bottom = chunk.rows[chunk.rows.length-1].getBoundingClientRect().bottom;
+                chunk.height = bottom - top;
+            }
+            else {
+                top = chunk.placeholder.getBoundingClientRect().top;
+                bottom = top + chunk.height;
+            }
+            var near = bottom > view.top - margin && top < view.bottom + margin;
+            if (near != chunk.attached) {
+                changes.push(chunk);
+            }
+        }
+        for (var i = 0; i < changes.length; ++i) {
+            if (changes[i].attached) {
+                detach(changes[i]);
+            }
+            else {
+                attach(changes[i]);
+            }
+        }
+    }
+
+    function requestUpdate() {
+        if (!frameRequested) {
+            frameRequested = true;
+            window.requestAnimationFrame(update);
+        }
+    }
+
+    // puts back the chunk holding the target of the link
+    function showTarget() {
+        var id = decodeURIComponent(location.hash.substr(1));
+        if (id == "" || document.getElementById(id) !== null) {
+            return;
+        }
+        var selector = "#" + CSS.escape(id) + ", [name=\"" + CSS.escape(id) + "\"]";
+        for (var i = 0; i < chunks.length; ++i) {
+            if (chunks[i].attached) {
+                continue;
+            }
+            for (var j = 0; j < chunks[i].rows.length; ++j) {
+                var target = chunks[i].rows[j].querySelector(selector);
+                if (target !== null) {
+                    attach(chunks[i]);
+                    target.scrollIntoView();
+                    return;
+                }
+            }
+        }
+    }
+
+    this.install = function() {
+        $(document).ready(function() {
+            $("table.memberdecls > tbody").each(function() {
+                split(this);
+            });
+            if (chunks.length == 0) {
+                return;
+            }
+
+            // reading the position of the rows would lay out the whole table
+            var screenRows = Math.ceil(window.innerHeight / rowHeight);
+            for (var i = 0; i < chunks.length; ++i) {
+                if (chunks[i].start >= screenRows) {
+                    detach(chunks[i]);
+                }
+            }
+
+            var content = document.getElementById("doc-content");
+            if (content !== null && /auto|scroll/.test(getComputedStyle(content).overflowY)) {
+                scroller = content;
+            }
+            scroller.addEventListener("scroll", requestUpdate, {passive: true});
+            window.addEventListener("resize", requestUpdate, {passive: true});
+            window.addEventListener("hashchange", showTarget);
+            showTarget();
+            requestUpdate();
+        });
+    }
+}
+
+// execute the function
+new MemberTables(100, 2000, 2000, 20).install();
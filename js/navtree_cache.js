@@ -0,0 +1,164 @@
+// Keeps the data of the tree view (navtreeindex*.js and the files holding the
+// children of tree nodes) parsed in IndexedDB so it does not have to be
+// downloaded and executed on every page. The files are parsed as JSON in a
+// worker. All cached data is dropped when the documentation is regenerated,
+// which is detected by the ETag or Last-Modified header of navtreedata.js
+// since doxygen writes that file once per run.
+// Only files consisting of a single 'var NAME = <JSON>;' are parsed, which is
+// how doxygen writes navtreeindex*.js and the files of the tree nodes. Any
+// other file is loaded by doxygen's own getScript instead.
+function NavTreeCache () {
+    var database = null;   // promise of the IndexedDB or null if unavailable
+    var version = null;    // promise of the version of the data
+    var worker = null;
+    var requests = {};     // pending worker requests by id
+    var nextId = 0;
+    var pruned = false;    // entries of older versions removed
+
+    // runs in the worker
+    function workerMain() {
+        onmessage = function(e) {
+            fetch(e.data.url).then(function(response) {
+                if (!response.ok) {
+                    throw new Error(response.statusText);
+                }
+                return response.text();
+            }).then(function(text) {
+                var match = /^var ([A-Za-z_$][\w$]*) =\s*([\[{][\s\S]*[\]}]);\s*$/.exec(text);
+                if (match === null) {
+                    throw new Error("unexpected format");
+                }
+                postMessage({id: e.data.id, name: match[1], value: JSON.parse(match[2])});
+            }).catch(function() {
+                postMessage({id: e.data.id, error: true});
+            });
+        };
+    }
+
+    function parseInWorker(url) {
+        if (worker === null) {
+            var source = "(" + workerMain.toString() + ")();";
+            worker = new Worker(URL.createObjectURL(new Blob([source])));
+            worker.onmessage = function(e) {
+                var request = requests[e.data.id];
+                delete requests[e.data.id];
+                if (e.data.error) {
+                    request.reject();
+                }
+                else {
+                    request.resolve({name: e.data.name, value: e.data.value});
+                }
+            };
+        }
+        return new Promise(function(resolve, reject) {
+            var id = nextId++;
+            requests[id] = {resolve: resolve, reject: reject};
+            worker.postMessage({id: id, url: url});
+        });
+    }
+
+    function openDatabase() {
+        if (database === null) {
+            database = new Promise(function(resolve) {
+                var request = indexedDB.open("that_style_navtree", 1);
+                request.onupgradeneeded = function() {
+                    request.result.createObjectStore("files");
+                };
+                request.onsuccess = function() { resolve(request.result); };
+                request.onerror = function() { resolve(null); };
+            });
+        }
+        return database;
+    }
+
+    // only the headers of navtreedata.js are requested, the page has loaded
+    // the file itself already
+    function currentVersion() {
+        if (version === null) {
+            var script = document.querySelector('script[src$="navtreedata.js"]');
+            version = !script ? Promise.reject() : fetch(script.src, {method: "HEAD", cache: "no-cache"}).then(function(response) {
+                var value = response.headers.get("ETag") || response.headers.get("Last-Modified");
+                if (!response.ok || !value) {
+                    throw new Error("no version");
+                }
+                return value;
+            });
+        }
+        return version;
+    }
+
+    function lookup(db, url, version) {
+        return new Promise(function(resolve) {
+            if (db === null) {
+                resolve(null);
+                return;
+            }
+            var request = db.transaction("files").objectStore("files").get(url);
+            request.onsuccess = function() {
+                var entry = request.result;
+                resolve(entry && entry.version == version ? entry : null);
+            };
+            request.onerror = function() { resolve(null); };
+        });
+    }
+
+    // the first write of a page also removes the data of older versions
+    function store(db, url, entry, version) {
+        if (db === null) {
+            return;
+        }
+        var files = db.transaction("files", "readwrite").objectStore("files");
+        files.put({version: version, name: entry.name, value: entry.value}, url);
+        if (!pruned) {
+            pruned = true;
+            files.openCursor().onsuccess = function(e) {
+                var cursor = e.target.result;
+                if (cursor) {
+                    if (cursor.value.version != version) {
+                        cursor["delete"]();
+                    }
+                    cursor["continue"]();
+                }
+            };
+        }
+    }
+
+    function load(url) {
+        return Promise.all([openDatabase(), currentVersion()]).then(function(results) {
+            var db = results[0], version = results[1];
+            return lookup(db, url, version).then(function(entry) {
+                if (entry !== null) {
+                    return entry;
+                }
+                return parseInWorker(url).then(function(entry) {
+                    store(db, url, entry, version);
+                    return entry;
+                });
+            });
+        });
+    }
+
+    // replaces getScript from doxygen's navtree.js which loads the data
+    // by inserting script elements
+    this.install = function() {
+        if (typeof getScript != "function" || location.protocol == "file:"
+            || !window.Worker || !window.indexedDB || !window.fetch || !window.Promise) {
+            return;
+        }
+
+        var doxygenGetScript = getScript;
+        getScript = function(scriptName, func, show) {
+            var url = new URL(scriptName + ".js", document.baseURI).href;
+            load(url).then(function(entry) {
+                // navtree.js looks the data up by the variable name
+                window[entry.name] = entry.value;
+                func();
+            }, function() {
+                doxygenGetScript(scriptName, func, show);
+            });
+        };
+    }
+}
+
+// execute the function
+new NavTreeCache().install();
@@ -0,0 +1,64 @@
+// Asks the browser to prefetch the pages that are most likely opened next
+// once the current page is idle. Candidates are ranked by the kind of link
+// pointing to them: base classes of the members inherited by a class, the
+// groups the page belongs to, the pages of the navigation path and finally
+// the classes and members linked most often from the summary.
+// Nothing is prefetched when saving data or on weak devices (see header.html).
+function Prefetcher (maxPages) {
+    var signals = [
+        {selector: "tr.inherit_header a.el", weight: 8},
+        {selector: "div.ingroups a.el", weight: 6},
+        {selector: "#nav-path li.navelem a.el", weight: 4},
+        {selector: "table.memberdecls td.memItemRight a.el, table.memberdecls td.memTemplItemRight a.el", weight: 1}
+    ];
+
+    function rank() {
+        var scores = {};
+        var here = location.href.replace(/#.*/, "");
+        $.each(signals, function(i, signal) {
+            $(signal.selector).each(function() {
+                var url = this.href.replace(/#.*/, "");
+                if (url != here && /^https?:/.test(url)) {
+                    scores[url] = (scores[url] || 0) + signal.weight;
+                }
+            });
+        });
+        return Object.keys(scores).sort(function(a, b) {
+            return scores[b] - scores[a];
+        }).slice(0, maxPages);
+    }
+
+    function prefetch() {
+        var head = document.getElementsByTagName("head")[0];
+        $.each(rank(), function(i, url) {
+            var link = document.createElement("link");
+            link.rel = "prefetch";
+            link.href = url;
+            head.appendChild(link);
+        });
+    }
+
+    this.install = function() {
+        if (document.documentElement.classList.contains("low-power")) {
+            return;
+        }
+        var schedule = function() {
+            if (window.requestIdleCallback) {
+                requestIdleCallback(prefetch, {timeout: 5000});
+            }
+            else {
+                setTimeout(prefetch, 1000);
+            }
+        };
+        // loaded with async, the page might be complete already
+        if (document.readyState == "complete") {
+            schedule();
+        }
+        else {
+            $(window).on("load", schedule);
+        }
+    }
+}
+
+// execute the function
+new Prefetcher(5).install();
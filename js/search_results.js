@@ -0,0 +1,375 @@
+// Shows the results of doxygen's client side search in a list that only
+// renders the visible rows instead of loading the results page (which
+// contains a row for every symbol starting with the same letter) into
+// the iframe in #MSearchResultsWindow. Matches are collected in small
+// time slices which are abandoned as soon as the query changes.
+// The arrow keys move through the list, Enter opens the selected result.
+//
+// The search can include other documentation generated with doxygen,
+// their roots are listed in the data-sites attribute of the script element.
+// Only the data file for the first letter of the query is loaded from
+// each of them.
+function SearchResultsList (rowHeight, siteRoots) {
+    var list = null;        // scroll container
+    var spacer = null;      // gives the container its full height
+    var status = null;
+    var results = [];       // ranked matches: {name, url, scope}
+    var selected = -1;      // index of the result selected with the keyboard
+    var generation = 0;     // incremented for every new query
+    var frameRequested = false;
+    var data = {};          // loaded search data by url, i.e. per site, section and letter
+    var loading = {};       // functions waiting for a script by url
+    var sites = null;       // searchable sites, this one first
+    var pendingSites = [];  // functions waiting for sites to be loaded
+
+    // loads a script and passes the value of the global variable name to
+    // func, every url is only requested once even while typing quickly
+    function loadScript(url, name, func) {
+        if (data.hasOwnProperty(url)) {
+            func(data[url]);
+            return;
+        }
+        if (loading.hasOwnProperty(url)) {
+            loading[url].push(func);
+            return;
+        }
+        loading[url] = [func];
+        function done(value) {
+            data[url] = value;
+            var waiting = loading[url];
+            delete loading[url];
+            for (var i = 0; i < waiting.length; ++i) {
+                waiting[i](value);
+            }
+        }
+        var script = document.createElement("script");
+        script.src = url;
+        script.onload = function() { done(window[name]); };
+        script.onerror = function() { done(null); };
+        document.getElementsByTagName("head")[0].appendChild(script);
+    }
+
+    // loads search/searchdata.js of all other sites, it defines the same
+    // variables as the one of this site which are restored afterwards
+    function withSites(resultsPath, func) {
+        if (sites !== null) {
+            func();
+            return;
+        }
+        pendingSites.push(func);
+        if (pendingSites.length > 1) {
+            return;
+        }
+
+        var local = {sections: indexSectionsWithContent, names: indexSectionNames,
+                     labels: window.indexSectionLabels};
+        var loaded = [{label: "", resultsPath: resultsPath,
+                       sections: local.sections, names: local.names}];
+        var remaining = siteRoots.length;
+
+        function done() {
+            if (--remaining <= 0) {
+                sites = loaded;
+                for (var i = 0; i < pendingSites.length; ++i) {
+                    pendingSites[i]();
+                }
+                pendingSites = [];
+            }
+        }
+
+        if (remaining == 0) {
+            ++remaining;
+            done();
+        }
+        $.each(siteRoots, function(i, root) {
+            var path = root.replace(/\/?$/, "/search");
+            loadScript(path + "/searchdata.js", "indexSectionsWithContent", function(sections) {
+                if (sections) {
+                    loaded.push({label: root.replace(/\/$/, "").replace(/.*\//, ""),
+                                 resultsPath: path, sections: sections,
+                                 names: indexSectionNames});
+                }
+                window.indexSectionsWithContent = local.sections;
+                window.indexSectionNames = local.names;
+                window.indexSectionLabels = local.labels;
+                done();
+            });
+        });
+    }
+
+    // the data file of a site for the given section and query, same lookup as doxygen
+    function shardUrl(site, sectionName, term) {
+        var idxChar = term.substr(0, 1);
+        var code = term.charCodeAt(0);
+        if (0xD800 <= code && code <= 0xDBFF && term.length > 1) {
+            idxChar = term.substr(0, 2);
+        }
+        for (var key in site.names) {
+            if (site.names[key] == sectionName) {
+                var idx = site.sections[key].indexOf(idxChar);
+                return idx == -1 ? null
+                    : site.resultsPath + "/" + sectionName + "_" + idx.toString(16) + ".js";
+            }
+        }
+        return null;
+    }
+
+    function link(url, resultsPath) {
+        return /^[a-z]+:/i.test(url) ? url : resultsPath + "/" + url;
+    }
+
+    // renders the rows in the visible part of the list
+    function render() {
+        frameRequested = false;
+        var hadFocus = spacer.contains(document.activeElement);
+        var first = Math.floor(list.scrollTop / rowHeight);
+        var last = Math.min(results.length,
+                            first + Math.ceil(list.clientHeight / rowHeight) + 1);
+        var html = "";
+        for (var i = first; i < last; ++i) {
+            var result = results[i];
+            html += '<div class="SRResult' + (i == selected ? ' SRSelected' : '')
+                + '" style="top: ' + (i*rowHeight) + 'px">'
+                + '<div class="SREntry"><a class="SRSymbol" href="' + result.url + '">'
+                + result.name + '</a>';
+            if (result.scope) {
+                html += '<span class="SRScope">' + result.scope + '</span>';
+            }
+            html += '</div></div>';
+        }
+        spacer.style.height = (results.length*rowHeight) + "px";
+        spacer.innerHTML = html;
+        if (hadFocus) {
+            focusSelected();
+        }
+    }
+
+    function focusSelected() {
+        var link = spacer.querySelector(".SRSelected a.SRSymbol");
+        if (link !== null) {
+            link.focus();
+        }
+    }
+
+    // selects a result and scrolls it into view, -1 goes back to the search field
+    function select(index) {
+        if (index < 0 || results.length == 0) {
+            selected = -1;
+            render();
+            searchBox.DOMSearchField().focus();
+            return;
+        }
+        selected = Math.min(index, results.length-1);
+        var top = selected*rowHeight;
+        if (top < list.scrollTop) {
+            list.scrollTop = top;
+        }
+        else if (top + rowHeight > list.scrollTop + list.clientHeight) {
+            list.scrollTop = top + rowHeight - list.clientHeight;
+        }
+        render();
+        focusSelected();
+    }
+
+    function requestRender() {
+        if (!frameRequested) {
+            frameRequested = true;
+            window.requestAnimationFrame(render);
+        }
+    }
+
+    function showStatus(text) {
+        status.innerHTML = text;
+        status.style.display = text ? "block" : "none";
+    }
+
+    // the id of a name in doxygen's search data: lower case with all other
+    // characters written as _ and their hex code, like convertToId of search.js
+    function convertToId(term) {
+        var id = "";
+        for (var i = 0; i < term.length; ++i) {
+            var c = term.charAt(i);
+            var code = term.charCodeAt(i);
+            if (/[a-z0-9\u0080-\uFFFF]/.test(c)) {
+                id += c;
+            }
+            else {
+                id += (code < 16 ? "_0" : "_") + code.toString(16);
+            }
+        }
+        return id;
+    }
+
+    // exact matches first, then all other names starting with term,
+    // compared by id since the names are html
+    function rank(shards, term) {
+        var current = generation;
+        var termId = convertToId(term);
+        var exact = [];
+        var prefix = [];
+        var shard = 0;
+        var index = 0;
+
+        function slice() {
+            if (current != generation) {
+                return;   // the query has changed
+            }
+            var end = performance.now() + 8;
+            for (; shard < shards.length && performance.now() < end; ++index) {
+                var entries = shards[shard].entries;
+                if (index >= entries.length) {
+                    ++shard;
+                    index = -1;
+                    continue;
+                }
+
+                var id = entries[index][0];
+                if (id.substr(0, termId.length) != termId) {
+                    continue;
+                }
+                var name = entries[index][1][0];
+                var target = id.length == termId.length ? exact : prefix;
+                var label = shards[shard].label;
+                for (var j = 1; j < entries[index][1].length; ++j) {
+                    var entry = entries[index][1][j];
+                    target.push({name: name,
+                                 url: link(entry[0], shards[shard].resultsPath),
+                                 scope: label ? label + (entry[2] ? ": " + entry[2] : "")
+                                              : entry[2]});
+                }
+            }
+
+            results = exact.concat(prefix);
+            requestRender();
+            if (shard < shards.length) {
+                setTimeout(slice, 0);
+            }
+            else {
+                showStatus(results.length == 0 ? "No Matches" : "");
+            }
+        }
+        slice();
+    }
+
+    function create(parent) {
+        list = document.createElement("div");
+        list.id = "MSearchResultsList";
+        spacer = document.createElement("div");
+        spacer.className = "SRSpacer";
+        status = document.createElement("div");
+        status.className = "SRStatus";
+        list.appendChild(status);
+        list.appendChild(spacer);
+        parent.appendChild(list);
+        list.addEventListener("scroll", requestRender, {passive: true});
+
+        // Enter is handled by the focused link itself
+        list.addEventListener("keydown", function(e) {
+            if (e.key == "ArrowDown") {
+                select(selected+1);
+            }
+            else if (e.key == "ArrowUp") {
+                select(selected-1);
+            }
+            else if (e.key == "Escape") {
+                searchBox.CloseResultsWindow();
+                searchBox.DOMSearchField().focus();
+            }
+            else {
+                return;
+            }
+            e.preventDefault();
+        });
+    }
+
+    // wraps OnSearchFieldChange from doxygen's search.js which moves into
+    // the results iframe on Down and is not loaded anymore
+    function wrapFieldKeys(doxygenOnSearchFieldChange) {
+        return function(evt) {
+            var e = evt || window.event;
+            var shown = list !== null && this.DOMPopupSearchResultsWindow().style.display == "block";
+            if (shown && results.length > 0 && !e.shiftKey && (e.keyCode == 40 || e.keyCode == 13)) {
+                if (e.keyCode == 40) {
+                    select(0);
+                }
+                else {
+                    location.href = results[0].url;
+                }
+                return;
+            }
+            return doxygenOnSearchFieldChange.apply(this, arguments);
+        };
+    }
+
+    // replaces SearchBox.Search from doxygen's search.js
+    function search() {
+        this.keyTimeout = 0;
+        var searchValue = this.DOMSearchField().value.replace(/^ +/, "");
+        var term = searchValue.toLowerCase();
+        var sectionName = indexSectionNames[this.searchIndex];
+        var current = ++generation;
+        results = [];
+        selected = -1;
+
+        var resultsWindow = this.DOMPopupSearchResultsWindow();
+        if (list === null) {
+            create(resultsWindow);
+        }
+        this.DOMPopupSearchResults().style.display = "none";
+        list.scrollTop = 0;
+        render();
+        showStatus("Searching...");
+
+        withSites(this.resultsPath, function() {
+            var shards = [];
+            var remaining = sites.length;
+            function done() {
+                if (--remaining == 0 && current == generation) {
+                    // keep the order of the sites
+                    rank($.grep(shards, function(shard) { return shard; }), term);
+                }
+            }
+
+            $.each(sites, function(i, site) {
+                var url = shardUrl(site, sectionName, term);
+                if (url === null) {
+                    done();
+                    return;
+                }
+                loadScript(url, "searchData", function(entries) {
+                    if (entries) {
+                        shards[i] = {entries: entries, label: site.label,
+                                     resultsPath: site.resultsPath};
+                    }
+                    done();
+                });
+            });
+        });
+
+        // below the search box, aligned to its right edge
+        if (typeof this.DOMSearchClose == "function") {
+            this.DOMSearchClose().style.display = "inline";
+        }
+        var box = this.DOMSearchBox().getBoundingClientRect();
+        resultsWindow.style.display = "block";
+        var left = box.right + window.pageXOffset - resultsWindow.offsetWidth;
+        resultsWindow.style.left = Math.max(10, left) + "px";
+        resultsWindow.style.top = (box.bottom + window.pageYOffset) + "px";
+
+        this.lastSearchValue = searchValue;
+    }
+
+    this.install = function() {
+        $(document).ready(function() {
+            if (typeof searchBox != "object" || typeof indexSectionsWithContent != "object") {
+                return;  // no search or server side search
+            }
+            searchBox.Search = search;
+            searchBox.OnSearchFieldChange = wrapFieldKeys(searchBox.OnSearchFieldChange);
+        });
+    }
+}
+
+// execute the function
+new SearchResultsList(36, $.grep((document.currentScript.getAttribute("data-sites") || "")
+                                 .split(/\s+/), function(root) { return root != ""; })).install();
@@ -1,5 +1,15 @@
 // Adds extra CSS classes "even" and "odd" to .memberdecls to allow
 // striped backgrounds.
+//
+// Rules, which any replacement has to reproduce exactly:
+// - all rows of all .memberdecls tables are visited in document order with
+//   a single counter, it is not reset between tables
+// - a .heading row resets the counter and is always "even"
+// - every row gets "odd" or "even" depending on the counter
+// - a row whose class attribute starts with "separator" ends a member,
+//   the counter is advanced after the row itself has been striped
+//   (so the memitem, memdesc and separator rows of a member share a class)
+// bench/striped_bg.js checks these rules and measures the speed.
 function MemberDeclsStriper () {
     var counter = 0;
     
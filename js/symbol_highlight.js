@@ -0,0 +1,92 @@
+// Highlights all occurrences of a symbol in source listings when it is
+// clicked with the Alt key held down. 'n' and 'N' jump to the next and
+// previous occurrence, Escape removes the highlight.
+function SymbolHighlighter () {
+    var occurrences = null;  // links in fragments by their target, built on first use
+    var highlighted = [];
+    var current = -1;
+    var status = null;
+
+    // one pass over all fragments, links are visited in line order
+    function buildIndex() {
+        occurrences = {};
+        var links = document.querySelectorAll("div.fragment a.code, div.fragment a.codeRef");
+        for (var i = 0; i < links.length; ++i) {
+            var target = links[i].getAttribute("href");
+            if (!occurrences.hasOwnProperty(target)) {
+                occurrences[target] = [];
+            }
+            occurrences[target].push(links[i]);
+        }
+    }
+
+    function showStatus() {
+        if (status === null) {
+            status = document.createElement("div");
+            status.id = "symbol-occurrences";
+            document.body.appendChild(status);
+        }
+        status.innerHTML = highlighted.length == 0 ? ""
+            : (current+1) + " / " + highlighted.length;
+        status.style.display = highlighted.length == 0 ? "none" : "block";
+    }
+
+    function select(index) {
+        if (current != -1) {
+            highlighted[current].classList.remove("current");
+        }
+        current = (index + highlighted.length) % highlighted.length;
+        highlighted[current].classList.add("current");
+        highlighted[current].scrollIntoView({block: "center"});
+        showStatus();
+    }
+
+    function clear() {
+        for (var i = 0; i < highlighted.length; ++i) {
+            highlighted[i].classList.remove("symbol-occurrence", "current");
+        }
+        highlighted = [];
+        current = -1;
+        showStatus();
+    }
+
+    function highlight(link) {
+        if (occurrences === null) {
+            buildIndex();
+        }
+        clear();
+        highlighted = occurrences[link.getAttribute("href")] || [link];
+        for (var i = 0; i < highlighted.length; ++i) {
+            highlighted[i].classList.add("symbol-occurrence");
+        }
+        select(highlighted.indexOf(link));
+    }
+
+    this.install = function() {
+        $(document).on("click", "div.fragment a.code, div.fragment a.codeRef", function(e) {
+            if (e.altKey) {
+                e.preventDefault();
+                highlight(this);
+            }
+        });
+
+        $(document).on("keydown", function(e) {
+            if (highlighted.length == 0 || e.ctrlKey || e.altKey || e.metaKey
+                || /^(input|textarea|select)$/i.test(e.target.tagName)) {
+                return;
+            }
+            if (e.key == "n") {
+                select(current+1);
+            }
+            else if (e.key == "N") {
+                select(current-1);
+            }
+            else if (e.key == "Escape") {
+                clear();
+            }
+        });
+    }
+}
+
+// execute the function
+new SymbolHighlighter().install();
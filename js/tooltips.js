@@ -0,0 +1,150 @@
+// Shows the tooltips of links in source listings (the .ttc blocks written by
+// doxygen) in #powerTip. Replaces the powerTip plugin which is bound to every
+// single link and measures the layout on every mouse move.
+function TooltipController (delay) {
+    var tip = null;
+    var anchor = null;        // link the tooltip is (going to be) shown for
+    var showTimer = null;
+    var hideTimer = null;
+    var frameRequested = false;
+    var geometry = null;      // cached positions, dropped on scroll and resize
+
+    function content(link) {
+        // same lookup as doxygen's own initialization code
+        var id = $(link).attr("href").replace(/.*\//, "").replace(/[^a-z_A-Z0-9]/g, "_");
+        return $("#" + id).html();
+    }
+
+    function measure() {
+        var rect = anchor.getBoundingClientRect();
+        geometry = {
+            left: rect.left + window.pageXOffset,
+            top: rect.top + window.pageYOffset,
+            width: rect.width,
+            height: rect.height,
+            tipWidth: tip.offsetWidth,
+            tipHeight: tip.offsetHeight,
+            viewLeft: window.pageXOffset,
+            viewTop: window.pageYOffset,
+            viewWidth: document.documentElement.clientWidth,
+            viewHeight: document.documentElement.clientHeight
+        };
+    }
+
+    // places the tooltip below the link or above it if there is no room
+    function position() {
+        frameRequested = false;
+        if (anchor === null || tip.style.display == "none") {
+            return;
+        }
+        if (geometry === null) {
+            measure();
+        }
+        var g = geometry;
+
+        var left = g.left + g.width/2 - g.tipWidth/2;
+        left = Math.max(g.viewLeft, Math.min(left, g.viewLeft + g.viewWidth - g.tipWidth));
+        var top = g.top + g.height;
+        if (top + g.tipHeight > g.viewTop + g.viewHeight && g.top - g.tipHeight >= g.viewTop) {
+            top = g.top - g.tipHeight;
+        }
+
+        tip.style.left = left + "px";
+        tip.style.top = top + "px";
+    }
+
+    function requestPosition() {
+        if (!frameRequested) {
+            frameRequested = true;
+            window.requestAnimationFrame(position);
+        }
+    }
+
+    function show() {
+        showTimer = null;
+        var html = content(anchor);
+        if (!html) {
+            return;
+        }
+        tip.innerHTML = html;
+        tip.style.display = "block";
+        geometry = null;
+        requestPosition();
+    }
+
+    function hide() {
+        hideTimer = null;
+        anchor = null;
+        geometry = null;
+        tip.style.display = "none";
+    }
+
+    function enter(link) {
+        clearTimeout(hideTimer);
+        hideTimer = null;
+        if (link === anchor) {
+            return;
+        }
+        clearTimeout(showTimer);
+        if (anchor !== null && tip.style.display != "none") {
+            // moving from one link to the next, no need to wait again
+            anchor = link;
+            show();
+        }
+        else {
+            anchor = link;
+            showTimer = setTimeout(show, delay);
+        }
+    }
+
+    function leave() {
+        clearTimeout(showTimer);
+        showTimer = null;
+        if (tip.style.display == "none") {
+            anchor = null;
+        }
+        else if (hideTimer === null) {
+            // give the mouse some time to move onto the tooltip
+            hideTimer = setTimeout(hide, 100);
+        }
+    }
+
+    this.install = function() {
+        // keep doxygen from binding the plugin to every link
+        $.fn.powerTip = function() { return this; };
+        if (document.documentElement.classList.contains("low-power")) {
+            return;  // no tooltips on weak devices, see header.html
+        }
+
+        $(document).ready(function() {
+            tip = document.getElementById("powerTip");
+            if (tip === null) {
+                tip = document.createElement("div");
+                tip.id = "powerTip";
+                document.body.appendChild(tip);
+            }
+            tip.style.display = "none";
+
+            $(document).on("mouseover focusin", "a.code, a.codeRef", function() {
+                enter(this);
+            });
+            $(document).on("mouseout focusout", "a.code, a.codeRef", leave);
+            $(tip).on("mouseenter", function() {
+                clearTimeout(hideTimer);
+                hideTimer = null;
+            });
+            $(tip).on("mouseleave", leave);
+
+            // capture scrolling of #doc-content as well
+            var invalidate = function() {
+                geometry = null;
+                requestPosition();
+            };
+            document.addEventListener("scroll", invalidate, {capture: true, passive: true});
+            window.addEventListener("resize", invalidate, {passive: true});
+        });
+    }
+}
+
+// execute the function
+new TooltipController(300).install();
@@ -0,0 +1,113 @@
+// Removes the whitespace and comments from the pages written by doxygen
+// that do not change how they are displayed, and reports the bytes saved.
+//
+//   node tools/minify_html.js [--dry-run] <html output directory>
+//
+// Runs of whitespace are collapsed to a single space and dropped next to
+// block level tags (tables, rows, cells, divs, ...), where the browser
+// ignores them anyway. Code fragments (div.fragment, whose lines are
+// white-space: pre), <pre>, <script>, <style> and <textarea> are copied
+// unchanged, and so are conditional comments.
+// With --dry-run the files are left as they are and only the report is
+// printed.
+var fs = require("fs");
+var path = require("path");
+var zlib = require("zlib");
+
+var dryRun = false;
+var directory = null;
+process.argv.slice(2).forEach(function(arg) {
+    if (arg == "--dry-run") {
+        dryRun = true;
+    }
+    else {
+        directory = arg;
+    }
+});
+if (directory === null) {
+    console.error("usage: node tools/minify_html.js [--dry-run] <html output directory>");
+    process.exit(2);
+}
+
+var protectedStart = /<(pre|script|style|textarea)\b[^>]*>|<div\s[^>]*class="(?:[^"]*\s)?fragment(?:\s[^"]*)?"[^>]*>/gi;
+var blockTags = "html|head|body|title|meta|link|div|table|tbody|thead|tr|td|th|ul|ol|li|dl|dt|dd|p|h[1-6]|br|hr|map|area|iframe|form";
+var aroundBlock = new RegExp("\\s*(</?(?:" + blockTags + ")\\b[^>]*>)\\s*", "gi");
+
+// end of a protected element starting at the match of protectedStart
+function protectedEnd(html, match) {
+    if (match[1]) {
+        var close = html.toLowerCase().indexOf("</" + match[1].toLowerCase(), match.index);
+        return close == -1 ? html.length : html.indexOf(">", close) + 1;
+    }
+    // fragments contain a div for every line
+    var tags = /<div\b|<\/div\s*>/gi;
+    tags.lastIndex = match.index;
+    var depth = 0;
+    var tag;
+    while ((tag = tags.exec(html))) {
+        depth += tag[0].charAt(1) == "/" ? -1 : 1;
+        if (depth == 0) {
+            return tags.lastIndex;
+        }
+    }
+    return html.length;
+}
+
+function minifyText(text) {
+    return text.replace(/<!--(?!\[if)[\s\S]*?-->/g, "")
+               .replace(/\s+/g, " ")
+               .replace(aroundBlock, "$1");
+}
+
+function minify(html) {
+    var result = "";
+    var position = 0;
+    var match;
+    protectedStart.lastIndex = 0;
+    while ((match = protectedStart.exec(html))) {
+        var end = protectedEnd(html, match);
+        result += minifyText(html.substring(position, match.index)) + html.substring(match.index, end);
+        position = protectedStart.lastIndex = end;
+    }
+    return (result + minifyText(html.substring(position))).replace(/^\s+/, "");
+}
+
+function htmlFiles(dir) {
+    var files = [];
+    fs.readdirSync(dir).forEach(function(name) {
+        var file = path.join(dir, name);
+        if (fs.statSync(file).isDirectory()) {
+            files.push.apply(files, htmlFiles(file));
+        }
+        else if (/\.html$/.test(name)) {
+            files.push(file);
+        }
+    });
+    return files;
+}
+
+function kB(bytes) {
+    return (bytes / 1024).toFixed(1) + " kB";
+}
+
+var total = {before: 0, after: 0, gzipBefore: 0, gzipAfter: 0};
+var files = htmlFiles(directory);
+files.forEach(function(file) {
+    var html = fs.readFileSync(file, "utf8");
+    var minified = minify(html);
+    total.before += Buffer.byteLength(html);
+    total.after += Buffer.byteLength(minified);
+    total.gzipBefore += zlib.gzipSync(html).length;
+    total.gzipAfter += zlib.gzipSync(minified).length;
+    if (!dryRun && minified != html) {
+        fs.writeFileSync(file, minified);
+    }
+});
+
+function saved(before, after) {
+    return kB(before) + " -> " + kB(after) + " ("
+        + (before == 0 ? 0 : (100 * (before - after) / before).toFixed(1)) + "% less)";
+}
+console.log(files.length + " files" + (dryRun ? " (dry run)" : ""));
+console.log("html:    " + saved(total.before, total.after));
+console.log("gzipped: " + saved(total.gzipBefore, total.gzipAfter));
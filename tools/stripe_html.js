@@ -0,0 +1,66 @@
+// Adds the classes "odd" and "even" to the rows of the member summaries in
+// the pages written by doxygen, like js/striped_bg.js does in the browser.
+// Meant for the lightweight version, which has no javascript.
+//
+//   node tools/stripe_html.js <html output directory>
+//
+// Follows the rules documented in js/striped_bg.js: one counter for all
+// tables of a page, reset by .heading rows and advanced after every row
+// whose class starts with "separator".
+var fs = require("fs");
+var path = require("path");
+
+var directory = process.argv[2];
+if (!directory) {
+    console.error("usage: node tools/stripe_html.js <html output directory>");
+    process.exit(2);
+}
+
+function stripe(html) {
+    var counter = 0;
+    return html.replace(/<table class="memberdecls">[\s\S]*?<\/table>/g, function(table) {
+        return table.replace(/<tr\b([^>]*)>/g, function(tag, attributes) {
+            var match = /\sclass="([^"]*)"/.exec(attributes);
+            var className = match ? match[1] : "";
+            if (className.split(/\s+/).indexOf("heading") != -1) {
+                counter = 0;
+            }
+            var stripe = counter % 2 == 1 ? "odd" : "even";
+            if (className.indexOf("separator") == 0) {
+                counter++;
+            }
+            if (/(^| )(odd|even)( |$)/.test(className)) {
+                return tag;  // striped before
+            }
+            if (match) {
+                return tag.replace(match[0], ' class="' + className + " " + stripe + '"');
+            }
+            return '<tr class="' + stripe + '"' + attributes + ">";
+        });
+    });
+}
+
+function htmlFiles(dir) {
+    var files = [];
+    fs.readdirSync(dir).forEach(function(name) {
+        var file = path.join(dir, name);
+        if (fs.statSync(file).isDirectory()) {
+            files.push.apply(files, htmlFiles(file));
+        }
+        else if (/\.html$/.test(name)) {
+            files.push(file);
+        }
+    });
+    return files;
+}
+
+var changed = 0;
+htmlFiles(directory).forEach(function(file) {
+    var html = fs.readFileSync(file, "utf8");
+    var striped = stripe(html);
+    if (striped != html) {
+        fs.writeFileSync(file, striped);
+        ++changed;
+    }
+});
+console.log(changed + " files striped");